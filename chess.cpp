@@ -7,12 +7,16 @@
 #include <algorithm>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
+#include <cassert>
+#include <string>
 
 //control paramaters
 const int max_ply             = 20;
 const float max_time_per_move = 10;
 const int max_chess_moves     = 218 / 2;
 const int max_score_entries   = 100000;
+const int bench_ply           = 4;
 
 //piece values, in centipawns
 const int king_value   = 20000;
@@ -433,6 +437,12 @@ auto all_moves(const board &brd, int colour)
 //start of move time
 auto start_time = std::chrono::high_resolution_clock::now();
 
+//search statistics and controls, bench turns off the move timer for repeatable node counts
+//and the progress output so only the search is timed
+auto timed_search = true;
+auto show_progress = true;
+unsigned long long nodes = 0;
+
 //memoized scores
 int score_impl(const score_board &sbrd, int colour, int alpha, int beta, int ply);
 auto score(const score_board &sbrd, int colour, int alpha, int beta, int ply)
@@ -463,6 +473,7 @@ auto score(const score_board &sbrd, int colour, int alpha, int beta, int ply)
 //pvs alpha/beta pruning minmax search for given ply
 int score_impl(const score_board &sbrd, int colour, int alpha, int beta, int ply)
 {
+	++nodes;
 	if (ply == 0) return -sbrd.score;
 	auto next_boards = all_moves(sbrd.brd, colour);
 	auto mate = true;
@@ -509,6 +520,7 @@ int score_impl(const score_board &sbrd, int colour, int alpha, int beta, int ply
 				return beta;
 			}
 			if (value > alpha) alpha = value;
+			if (!timed_search) continue;
 			auto end_time = std::chrono::high_resolution_clock::now();
 			std::chrono::duration<float> elapsed = end_time - start_time;
 			if (elapsed.count() >= max_time_per_move)
@@ -530,7 +542,7 @@ int score_impl(const score_board &sbrd, int colour, int alpha, int beta, int ply
 }
 
 //best move for given board position for given colour
-auto best_move(const board &brd, int colour, const boards &history)
+auto best_move(const board &brd, int colour, const boards &history, int max_depth = max_ply)
 {
 	//first ply of boards
 	auto next_boards = all_moves(brd, colour);
@@ -548,10 +560,10 @@ auto best_move(const board &brd, int colour, const boards &history)
 
 	//start move timer
 	start_time = std::chrono::high_resolution_clock::now();
-	for (auto ply = 1; ply <= max_ply; ++ply)
+	for (auto ply = 1; ply <= max_depth; ++ply)
  	{
 		//iterative deepening of ply so we allways have a best move to go with if the timer expires
-		std::cout << "\nPly = " << ply << " " << std::flush;
+		if (show_progress) std::cout << "\nPly = " << ply << " " << std::flush;
 		auto best_index = 0;
 		auto alpha = -mate_value*10;
 		auto beta = mate_value*10;
@@ -570,12 +582,12 @@ auto best_move(const board &brd, int colour, const boards &history)
 				//got a better board than last best
 				alpha = score_board->score;
 				best_index = index;
-				std::cout << "*" << std::flush;
+				if (show_progress) std::cout << "*" << std::flush;
 			}
 			else
 			{
 				//just tick off another board
-				std::cout << "." << std::flush;
+				if (show_progress) std::cout << "." << std::flush;
 			}
 		}
 		if (best_index != 0)
@@ -594,8 +606,58 @@ auto best_move(const board &brd, int colour, const boards &history)
 	return next_boards[0].brd;
 }
 
-int main(int, const char *[])
+//fixed depth search of built in positions, total nodes is a signature of the search
+auto bench(int depth)
+{
+	auto positions = std::vector<std::pair<board, int>>{
+		{"rnbqkbnrpppppppp                                PPPPPPPPRNBQKBNR", white},
+		{"rnbqkb rpppp ppp     n      p       P     N     PPPP PPPR BQKBNR", white},
+		{"r bqk  rpppp ppp  n  n    b p     B P      P N  PPP  PPPRNBQK  R", black},
+		{"r  q rk pp  ppbp  np np            NP     N BP  PPPQ  PPR   KB R", white},
+		{"  r  rk pp  ppbp   p np q          NP    BN BP  PPPQ  PP  KR   R", black},
+		{"             pk       p            R          P      PKP   r    ", white},
+		{"        p         k    p   rb         p      r              K   ", black},
+		{" k                         Q P     Q P  K                       ", white},
+		{"    k     R                               K                     ", white},
+		{"   k              KBB                                           ", white}};
+	auto history = boards{};
+	nodes = 0;
+	timed_search = false;
+	show_progress = false;
+	auto bench_start_time = std::chrono::high_resolution_clock::now();
+	for (auto &position : positions)
+	{
+		assert(position.first.length() == 64);
+		best_move(position.first, position.second, history, depth);
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> elapsed = end_time - bench_start_time;
+	auto nps = static_cast<unsigned long long>(nodes / std::max(elapsed.count(), 0.001));
+	std::cout << "Nodes: " << nodes << "\n";
+	std::cout << "Time: " << elapsed.count() << "\n";
+	std::cout << "Nodes/sec: " << nps << "\n";
+	return 0;
+}
+
+int main(int argc, const char *argv[])
 {
+	if (argc > 1 && std::string(argv[1]) == "bench")
+	{
+		//deterministic fixed depth benchmark, optional depth argument
+		auto depth = long(bench_ply);
+		if (argc > 2)
+		{
+			char *end;
+			depth = std::strtol(argv[2], &end, 10);
+			if (end == argv[2] || *end != '\0' || depth < 1 || depth > max_ply)
+			{
+				std::cerr << "usage: chess bench [depth 1.." << max_ply << "]\n";
+				return 1;
+			}
+		}
+		return bench(int(depth));
+	}
+
 	//setup first board, loop for white..black..white..black...
 	auto game_start_time = std::chrono::high_resolution_clock::now();
 	auto brd = board("rnbqkbnrpppppppp                                PPPPPPPPRNBQKBNR");